@@ -73,6 +73,26 @@ int kread(uint64_t from, void *to, size_t len);
 **/
 int kwrite(void *from, uint64_t to, size_t len);
 
+/**
+ * kcopy - Copy kernel memory
+ *
+ * Copies `len` bytes from the kernel address provided in `src` to the kernel
+ * address provided in `dst`. The two ranges may overlap, in which case the
+ * result is as if the source had first been copied to a temporary buffer.
+ * Both provided ranges must not overflow.
+ * On failure, no guarantee is made about the amout of bytes copied.
+**/
+int kcopy(uint64_t dst, uint64_t src, size_t len);
+
+/**
+ * kmemset - Fill kernel memory
+ *
+ * Sets `len` bytes at the kernel address provided in `dst` to the value given
+ * in `byte`. The provided range must not overflow.
+ * On failure, no guarantee is made about the amout of bytes written.
+**/
+int kmemset(uint64_t dst, uint8_t byte, size_t len);
+
 /**
  * kmalloc - Allocate kernel memory
  *
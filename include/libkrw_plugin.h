@@ -52,9 +52,11 @@ typedef int (*krw_kdealloc_func_t)(uint64_t addr, size_t size);
 typedef int (*krw_kcall_func_t)(uint64_t func, size_t argc, const uint64_t *argv, uint64_t *ret);
 typedef int (*krw_physread_func_t)(uint64_t from, void *to, size_t len, uint8_t granule);
 typedef int (*krw_physwrite_func_t)(void *from, uint64_t to, size_t len, uint8_t granule);
+typedef int (*krw_kcopy_func_t)(uint64_t dst, uint64_t src, size_t len);
+typedef int (*krw_kmemset_func_t)(uint64_t dst, uint8_t byte, size_t len);
 
 // This struct must only be extended so that old plugins can still load
-#define LIBKRW_HANDLERS_VERSION 0
+#define LIBKRW_HANDLERS_VERSION 1
 struct krw_handlers_s {
     uint64_t version;
     krw_kbase_func_t kbase;
@@ -65,6 +67,9 @@ struct krw_handlers_s {
     krw_kcall_func_t kcall;
     krw_physread_func_t physread;
     krw_physwrite_func_t physwrite;
+    // Version 1
+    krw_kcopy_func_t kcopy;
+    krw_kmemset_func_t kmemset;
 };
 
 typedef struct krw_handlers_s* krw_handlers_t;
@@ -86,6 +91,10 @@ typedef struct krw_handlers_s* krw_handlers_t;
  * kcall_initializer should set as many of handlers->kcall, handlers->physread, and
  * handlers->physwrite as possible on success.  any not set will return unsupported.
  *
+ * Either initializer may additionally set handlers->kcopy and handlers->kmemset
+ * (handlers version 1 and up), e.g. by calling memmove/memset in the kernel.
+ * Any not set will be emulated by libkrw on top of kread/kwrite.
+ *
  * Retuns 0 if read/write are supported by this plugin
 **/
 typedef int (*krw_plugin_initializer_t)(krw_handlers_t handlers);
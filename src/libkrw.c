@@ -10,6 +10,9 @@
 #include "libkrw_plugin.h"
 #include "libkrw_tfp0.h"
 
+// Size of the userland buffer used to emulate kcopy/kmemset via kread/kwrite
+#define KRW_STAGING_SIZE 0x4000
+
 static struct krw_handlers_s krw_handlers;
 
 static dispatch_once_t init_krw_handlers_once;
@@ -43,6 +46,8 @@ static int obtain_kcall_funcs(void *plugin) {
     krw_handlers.kcall = handlers.kcall;
     krw_handlers.physread = handlers.physread;
     krw_handlers.physwrite = handlers.physwrite;
+    krw_handlers.kcopy = handlers.kcopy;
+    krw_handlers.kmemset = handlers.kmemset;
     return 0;
 }
 
@@ -66,6 +71,8 @@ static int obtain_krw_funcs(void *plugin) {
     krw_handlers.kwrite = handlers.kwrite;
     krw_handlers.kmalloc = handlers.kmalloc;
     krw_handlers.kdealloc = handlers.kdealloc;
+    krw_handlers.kcopy = handlers.kcopy;
+    krw_handlers.kmemset = handlers.kmemset;
     return 0;
 }
 
@@ -107,6 +114,7 @@ static void iterate_plugins(int (*callback)(void *), void **check) {
 }
 
 static void init_krw_handlers(void *ctx) {
+    krw_handlers.version = LIBKRW_HANDLERS_VERSION;
     if (libkrw_initialization(&krw_handlers) != 0) {
         iterate_plugins(&obtain_krw_funcs, (void**)&krw_handlers.kread);
     }
@@ -160,3 +168,55 @@ int physwrite(void *from, uint64_t to, size_t len, uint8_t granule) {
     if (krw_handlers.physwrite == NULL) return ENOTSUP;
     return krw_handlers.physwrite(from, to, len, granule);
 }
+
+static int staged_kcopy(uint64_t dst, uint64_t src, size_t len) {
+    uint8_t buf[KRW_STAGING_SIZE];
+    // Walk backwards if dst overlaps the tail of src, so we never read back what we wrote
+    int backwards = dst > src && dst - src < len;
+    for (size_t done = 0, chunk = 0; done < len; done += chunk) {
+        chunk = len - done > sizeof(buf) ? sizeof(buf) : len - done;
+        size_t off = backwards ? len - done - chunk : done;
+        int r = krw_handlers.kread(src + off, buf, chunk);
+        if (r != 0) return r;
+        r = krw_handlers.kwrite(buf, dst + off, chunk);
+        if (r != 0) return r;
+    }
+    return 0;
+}
+
+static int staged_kmemset(uint64_t dst, uint8_t byte, size_t len) {
+    uint8_t buf[KRW_STAGING_SIZE];
+    size_t fill = len > sizeof(buf) ? sizeof(buf) : len;
+    memset(buf, byte, fill);
+    int r = krw_handlers.kwrite(buf, dst, fill);
+    if (r != 0) return r;
+    // If the backend can copy in-kernel, keep doubling the already filled prefix instead
+    for (size_t done = fill, chunk = 0; done < len; done += chunk) {
+        size_t max = krw_handlers.kcopy != NULL ? done : fill;
+        chunk = len - done > max ? max : len - done;
+        if (krw_handlers.kcopy != NULL) {
+            r = krw_handlers.kcopy(dst + done, dst, chunk);
+        } else {
+            r = krw_handlers.kwrite(buf, dst + done, chunk);
+        }
+        if (r != 0) return r;
+    }
+    return 0;
+}
+
+int kcopy(uint64_t dst, uint64_t src, size_t len) {
+    dispatch_once_f(&init_krw_handlers_once, NULL, &init_krw_handlers);
+    if (krw_handlers.kcopy != NULL) return krw_handlers.kcopy(dst, src, len);
+    if (krw_handlers.kread == NULL || krw_handlers.kwrite == NULL) return ENOTSUP;
+    if (src + len < src || dst + len < dst) return EINVAL;
+    return staged_kcopy(dst, src, len);
+}
+
+int kmemset(uint64_t dst, uint8_t byte, size_t len) {
+    dispatch_once_f(&init_krw_handlers_once, NULL, &init_krw_handlers);
+    if (krw_handlers.kmemset != NULL) return krw_handlers.kmemset(dst, byte, len);
+    if (krw_handlers.kwrite == NULL) return ENOTSUP;
+    if (dst + len < dst) return EINVAL;
+    if (len == 0) return 0;
+    return staged_kmemset(dst, byte, len);
+}
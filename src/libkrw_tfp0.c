@@ -7,6 +7,7 @@
 
 extern kern_return_t mach_vm_read_overwrite(task_t task, mach_vm_address_t addr, mach_vm_size_t size, mach_vm_address_t data, mach_vm_size_t *outsize);
 extern kern_return_t mach_vm_write(task_t task, mach_vm_address_t addr, mach_vm_address_t data, mach_msg_type_number_t dataCnt);
+extern kern_return_t mach_vm_copy(task_t task, mach_vm_address_t src, mach_vm_size_t size, mach_vm_address_t dst);
 extern kern_return_t mach_vm_allocate(task_t task, mach_vm_address_t *addr, mach_vm_size_t size, int flags);
 extern kern_return_t mach_vm_deallocate(task_t task, mach_vm_address_t addr, mach_vm_size_t size);
 
@@ -158,6 +159,61 @@ static int tfp0_kwrite(void *from, uint64_t to, size_t len)
     return 0;
 }
 
+static int tfp0_kcopy(uint64_t dst, uint64_t src, size_t len)
+{
+    // Overflow
+    if(src + len < src || dst + len < dst)
+    {
+        return EINVAL;
+    }
+
+    int r = assure_ktask();
+    if(r != 0)
+    {
+        return r;
+    }
+
+    // Walk backwards if dst overlaps the tail of src. If the two are closer than
+    // one chunk, each chunk would overlap itself, so bounce it through userland
+    // rather than relying on how mach_vm_copy orders its reads and writes.
+    int backwards = dst > src && dst - src < len;
+    int staged = (dst > src ? dst - src : src - dst) < 0xff0;
+    if(dst == src)
+    {
+        return 0;
+    }
+    uint8_t buf[0xff0];
+    for(mach_vm_size_t done = 0, chunk = 0; done < len; done += chunk)
+    {
+        chunk = len - done > 0xff0 ? 0xff0 : len - done;
+        mach_vm_size_t off = backwards ? len - done - chunk : done;
+        if(staged)
+        {
+            r = tfp0_kread(src + off, buf, chunk);
+            if(r == 0)
+            {
+                r = tfp0_kwrite(buf, dst + off, chunk);
+            }
+            if(r != 0)
+            {
+                return r == EDEVERR && done != 0 ? EIO : r;
+            }
+            continue;
+        }
+        kern_return_t ret = mach_vm_copy(gKernelTask, src + off, chunk, dst + off);
+        if(ret == KERN_INVALID_ARGUMENT || ret == KERN_INVALID_ADDRESS)
+        {
+            return EINVAL;
+        }
+        if(ret != KERN_SUCCESS)
+        {
+            // Check whether we copied any bytes at all
+            return done == 0 ? EDEVERR : EIO;
+        }
+    }
+    return 0;
+}
+
 static int tfp0_kmalloc(uint64_t *addr, size_t size)
 {
     int r = assure_ktask();
@@ -223,5 +279,9 @@ int libkrw_initialization(krw_handlers_t handlers) {
     handlers->kwrite = &tfp0_kwrite;
     handlers->kmalloc = &tfp0_kmalloc;
     handlers->kdealloc = &tfp0_kdealloc;
+#ifndef LIBKRW_TFP0_NO_KCOPY
+    // Build with -DLIBKRW_TFP0_NO_KCOPY to exercise the generic kcopy/kmemset fallbacks
+    handlers->kcopy = &tfp0_kcopy;
+#endif
     return 0;
 }
@@ -1,6 +1,51 @@
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "libkrw.h"
 
+static int big_test(uint64_t big, size_t biglen, uint8_t *ref, uint8_t *out)
+{
+    int r = kmemset(big, 0x5a, biglen);
+    printf("kmemset: %d\n", r);
+    if(r != 0) return r;
+    memset(ref, 0x5a, biglen);
+
+    r = kread(big, out, biglen);
+    printf("kread: %d\n", r);
+    if(r != 0) return r;
+    if(memcmp(ref, out, biglen) != 0)
+    {
+        printf("kmemset: mismatch\n");
+        return 1;
+    }
+
+    for(size_t i = 0; i < biglen; ++i) ref[i] = (uint8_t)(i * 7);
+    r = kwrite(ref, big, biglen);
+    printf("kwrite: %d\n", r);
+    if(r != 0) return r;
+
+    // Overlapping in both directions, closer than and further apart than a chunk
+    r = kcopy(big + 0x8, big, 0x9000);
+    printf("kcopy: %d\n", r);
+    if(r != 0) return r;
+    memmove(ref + 0x8, ref, 0x9000);
+
+    r = kcopy(big + 0x10, big + 0x5000, 0xa000);
+    printf("kcopy: %d\n", r);
+    if(r != 0) return r;
+    memmove(ref + 0x10, ref + 0x5000, 0xa000);
+
+    r = kread(big, out, biglen);
+    printf("kread: %d\n", r);
+    if(r != 0) return r;
+    if(memcmp(ref, out, biglen) != 0)
+    {
+        printf("kcopy: mismatch\n");
+        return 1;
+    }
+    return 0;
+}
+
 int main(void)
 {
     uint64_t base = 0;
@@ -28,6 +73,44 @@ int main(void)
     printf("kread: %d, 0x%llx\n", r, back);
     if(r != 0) return r;
 
+    r = kmemset(alloc + 0x8, 0x41, 0x8);
+    printf("kmemset: %d\n", r);
+    if(r != 0) return r;
+
+    r = kcopy(alloc + 0x4, alloc, 0x8);
+    printf("kcopy: %d\n", r);
+    if(r != 0) return r;
+
+    uint64_t copied[2] = {};
+    r = kread(alloc, copied, sizeof(copied));
+    printf("kread: %d, 0x%llx 0x%llx\n", r, copied[0], copied[1]);
+    if(r != 0) return r;
+    if(copied[0] != 0x5566778855667788 || copied[1] != 0x4141414111223344)
+    {
+        printf("kcopy: mismatch\n");
+        return 1;
+    }
+
+    // Larger than the staging buffer. With the tfp0 backend this runs tfp0_kcopy
+    // and the kcopy branch of the kmemset fallback; build libkrw with
+    // -DLIBKRW_TFP0_NO_KCOPY to run the generic kcopy/kmemset fallbacks instead.
+    size_t biglen = 0x10000;
+    uint64_t big = 0;
+    r = kmalloc(&big, biglen);
+    printf("kmalloc: %d, 0x%llx\n", r, big);
+    if(r != 0) return r;
+
+    uint8_t *ref = malloc(biglen);
+    uint8_t *out = malloc(biglen);
+    r = ref != NULL && out != NULL ? big_test(big, biglen, ref, out) : 1;
+    free(ref);
+    free(out);
+
+    int rd = kdealloc(big, biglen);
+    printf("kdealloc: %d\n", rd);
+    if(r != 0) return r;
+    if(rd != 0) return rd;
+
     r = kdealloc(alloc, 0x8);
     printf("kdealloc: %d\n", r);
     if(r != 0) return r;